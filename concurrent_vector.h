@@ -1471,6 +1471,12 @@ private:
     // Destroy _N instances of _Ty, starting at "begin".
     static void __cdecl _Destroy_array( void* _Begin, size_type _N );
 
+    // Copy the bits of _N trivially relocatable instances of _Ty, starting at "begin".
+    static void __cdecl _Relocate_array( void* _Dst, const void* _Src, size_type _N );
+
+    // Forget _N relocated instances of _Ty, starting at "begin"; their bits now live elsewhere.
+    static void __cdecl _Forget_array( void* _Begin, size_type _N );
+
     // Exception-aware helper class for filling a segment by exception-danger operators of user class
     class _Internal_loop_guide
     {
@@ -1533,7 +1539,10 @@ void concurrent_vector<_Ty, _Ax>::shrink_to_fit()
     _Internal_segments_table _Old = { 0, nullptr };
     try
     {
-        if( _Internal_compact( sizeof(_Ty), &_Old, &_Destroy_array, &_Copy_array ) )
+        // Trivially relocatable elements move to the compacted segment as raw bytes.
+        const bool _Relocate = std::is_trivially_relocatable<_Ty>::value;
+        if( _Internal_compact( sizeof(_Ty), &_Old, _Relocate ? &_Forget_array : &_Destroy_array,
+            _Relocate ? &_Relocate_array : &_Copy_array ) )
             _Internal_free_segments( _Old._Table, _Pointers_per_long_table, _Old._First_block ); // Free joined and unnecessary segments
     }
     catch(...)
@@ -1684,6 +1693,18 @@ void __cdecl concurrent_vector<_Ty, _Ax>::_Destroy_array( void* _Begin, size_typ
         _Array[_J-1].~_Ty(); // destructors are supposed to not throw any exceptions
 }
 
+template<typename _Ty, class _Ax>
+void __cdecl concurrent_vector<_Ty, _Ax>::_Relocate_array( void* _Dst, const void* _Src, size_type _N )
+{
+    if( _N > 0 )
+        std::memcpy( _Dst, _Src, _N * sizeof(_Ty) );
+}
+
+template<typename _Ty, class _Ax>
+void __cdecl concurrent_vector<_Ty, _Ax>::_Forget_array( void*, size_type )
+{
+}
+
 #pragma warning(pop)
 
 /// <summary>
@@ -607,6 +607,57 @@ public:
         return _Count;
     }
 
+    /// <summary>
+    ///     Measures chain lengths, probe costs and memory use of this container.
+    /// </summary>
+    /// <returns>
+    ///     The statistics. Each chain is the run of elements after one initialized bucket's
+    ///     dummy node; the elements of a bucket not yet initialized count with its parent's.
+    /// </returns>
+    /**/
+    std::_Container_stats unsafe_stats() const
+    {
+        std::_Container_stats _Stats = std::_Container_stats();
+        size_type _Dummies = 0;
+        size_type _Count = 0;
+
+        for (_Full_const_iterator _Iterator = _M_split_ordered_list._Begin(); _Iterator != _M_split_ordered_list._End(); _Iterator++)
+        {
+            if (_Iterator._Mynode()->_Is_dummy())
+            {
+                if (_Dummies++ != 0)
+                {
+                    _Stats._Add_chain(_Count);
+                }
+                _Count = 0;
+            }
+            else
+            {
+                _Count++;
+            }
+        }
+
+        if (_Dummies != 0)
+        {
+            _Stats._Add_chain(_Count);
+        }
+
+        _Stats.size = size();
+        _Stats.bucket_count = _M_number_of_buckets;
+        _Stats._Average(_Stats.size, _Stats.size);
+        _Stats.node_bytes = (_Stats.size + _Dummies) * sizeof(typename std::remove_pointer<_Nodeptr>::type);
+
+        for (size_type _Index = 0; _Index < _Pointers_per_table; _Index++)
+        {
+            if (_M_buckets[_Index] != NULL)
+            {
+                _Stats.bucket_bytes += _Segment_size(_Index) * sizeof(_Full_iterator);
+            }
+        }
+
+        return _Stats;
+    }
+
     /// <summary>
     ///     Returns the bucket index that a specific key maps to in this container.
     /// </summary>